@@ -8,10 +8,10 @@ integerparams = []
 characterparams = []
 for par in parameters:
   if par["type"] == "double":
-    if par["name"] not in ("D15", "D50", "D90", "sedcal", "ucrcal", "xpointsw", "ypointsw", "rugdepth"):
+    if par["name"] not in ("D15", "D50", "D90", "sedcal", "ucrcal", "xpointsw", "ypointsw", "rugdepth", "globaltolerance"):
       realparams.append(par)
   if par["type"] == "int":
-    if par["name"] not in ("pointtypes"):
+    if par["name"] not in ("pointtypes", "globaldeflate", "globalshuffle", "globalchunk", "globaldigits"):
       integerparams.append(par)
   if par["type"] == "char":
     if par["name"] not in ("globalvars", "meanvars", "pointvars", "stationid"):
@@ -2,3 +2,9 @@
   integer imin_uu,imax_uu,jmin_uu,jmax_uu
   integer imin_vv,imax_vv,jmin_vv,jmax_vv
   integer imin_zs,imax_zs,jmin_zs,jmax_zs
+  ! first and last wet point (i) in each row j, for wete, wetu, wetv and wetz
+  ! determined in compute_wetcells; for a row without wet points imin = nx+2 and imax = 0
+  integer, dimension(:), allocatable :: imin_wete,imax_wete
+  integer, dimension(:), allocatable :: imin_wetu,imax_wetu
+  integer, dimension(:), allocatable :: imin_wetv,imax_wetv
+  integer, dimension(:), allocatable :: imin_wetz,imax_wetz
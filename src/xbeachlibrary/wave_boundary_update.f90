@@ -1496,7 +1496,7 @@ subroutine generate_wavetrain_components(combspec,wp)
 #ifdef BUILDXBEACH
    use logging_module
    use interp
-   use wave_functions_module, only: iteratedispersion
+   use wave_functions_module, only: dispersion_kh
 #endif
    use wave_boundary_datastore
    use math_tools
@@ -1509,7 +1509,7 @@ subroutine generate_wavetrain_components(combspec,wp)
    integer                                      :: i,ii
    integer                                      :: ind1,ind2,dummy
    real*8,dimension(:),allocatable              :: randnums,pdflocal,cdflocal
-   real*8                                       :: L0,L,kmax,fmax,dummy_real
+   real*8                                       :: kmax,fmax,dummy_real
 
 
    ! If we are running non-hydrostatic boundary conditions, we want to remove
@@ -1619,20 +1619,10 @@ subroutine generate_wavetrain_components(combspec,wp)
       wp%thetagen(i) = mod(wp%thetagen(i),2*par_pi)
    enddo
 
-   ! determine wave number for each wave train component, using standard dispersion relation
-   ! solver from wave_functions module. This function returns a negative wave length if the
-   ! solver did not converge.
+   ! determine wave number for each wave train component, using the explicit dispersion
+   ! relation solver from wave_functions module
 #ifdef BUILDXBEACH
-   do i=1,wp%K
-      L0 = par_g*(1/wp%fgen(i))**2/2/par_pi    ! deep water wave length
-      L = iteratedispersion(L0,L0,par_pi,hb0)
-      if (L<0.d0) then
-         call writelog('lsw','','No dispersion convergence found for wave train ',i, &
-         ' in boundary condition generation')
-         L = -L
-      endif
-      wp%kgen(i) = 2*par_pi/L
-   enddo
+   wp%kgen(1:wp%K) = dispersion_kh((2*par_pi*wp%fgen(1:wp%K))**2*hb0/par_g)/hb0
 #else
    ! do dispersion relation in other model
 #endif
@@ -2,6 +2,7 @@ program run_xbeach_tests
 
     use ftnunit
     use interp_tests
+    use solver_tests
 
     implicit none
 
@@ -11,6 +12,7 @@ program run_xbeach_tests
 
     ! Run tests here
     call runtests( allInterpTests )
+    call runtests( allSolverTests )
     
     call runtests_final
 